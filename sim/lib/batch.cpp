@@ -0,0 +1,386 @@
+/*
+ * File: batch.cpp
+ * Created Date: 2026-10-19 05:25:00 am                                        *
+ * Author: agent                                                               *
+ * -----                                                                       *
+ * Last Modified: 2026-10-19 06:10:00 am
+ * Modified By: agent
+ * -----                                                                       *
+ * License: See LICENSE.md                                                     *
+ * Copyright (c) 2023 HerdWare                                                 *
+ * -----                                                                       *
+ * Description:                                                                *
+ */
+
+
+#include "batch.h"
+#include "verilated.h"
+#include "svdpi.h"
+#include "VCheeseSim__Dpi.h"
+
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace std;
+
+
+#define BATCH_SCOPE_BOOT  "TOP.CheeseSim.m_cheese.m_boot.m_ram.m_ram"
+#define BATCH_SCOPE_ROM   "TOP.CheeseSim.m_cheese.m_rom.m_ram.m_ram"
+#define BATCH_SCOPE_RAM   "TOP.CheeseSim.m_cheese.m_ram.m_ram.m_ram"
+#define BATCH_NRESET      5
+
+
+// ******************************
+//            QUEUES
+// ******************************
+// One queue per worker: the owner pops from the front, idle workers steal from the back.
+struct BatchQueue {
+  deque<int> prog;
+  mutex lock;
+};
+
+// ******************************
+//            SLOTS
+// ******************************
+struct BatchSlot {
+  VerilatedContext *ctx;
+  VCheeseSim *dut;
+  int id;             // Current program, -1 when idle
+  uint64_t clock;
+  uint32_t cycle;
+  uint32_t instret;
+};
+
+vector<string> batch_prog;
+vector<BatchQueue> batch_queue;
+FILE *f_batch = NULL;
+mutex batch_out_lock;
+
+char *batch_rom = NULL;
+string batch_zero_boot;
+string batch_zero_ram;
+int batch_nuartcycle = 50;
+int batch_argc = 0;
+char **batch_argv = NULL;
+
+// ******************************
+//           PROGRAMS
+// ******************************
+bool batch_pop(int t, int &id) {
+  int nthread = batch_queue.size();
+
+  // Own queue
+  {
+    lock_guard<mutex> guard(batch_queue[t].lock);
+    if (!batch_queue[t].prog.empty()) {
+      id = batch_queue[t].prog.front();
+      batch_queue[t].prog.pop_front();
+      return true;
+    }
+  }
+
+  // Steal
+  for (int o = 1; o < nthread; o++) {
+    BatchQueue &q = batch_queue[(t + o) % nthread];
+
+    lock_guard<mutex> guard(q.lock);
+    if (!q.prog.empty()) {
+      id = q.prog.back();
+      q.prog.pop_back();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// ******************************
+//           INSTANCES
+// ******************************
+// Zero image of nbyte bytes in the .hex format of ext_readmemh_byte
+bool batch_zero_image(long nbyte, string &path) {
+  char name[] = "/tmp/cheese-batch-XXXXXX";
+  int fd = mkstemp(name);
+
+  if (fd < 0) {
+    return false;
+  }
+
+  FILE *f = fdopen(fd, "w");
+  fprintf(f, "@00000000\n");
+  for (long b = 0; b < nbyte; b++) {
+    fprintf(f, ((b % 16) == 15) ? "00\n" : "00 ");
+  }
+  fprintf(f, "\n");
+  fclose(f);
+
+  path = name;
+  return true;
+}
+
+// One model per slot for the whole run
+void batch_init(BatchSlot &s) {
+  s.ctx = new VerilatedContext;
+  s.ctx->commandArgs(batch_argc, batch_argv);
+  s.dut = new VCheeseSim(s.ctx);
+  s.id = -1;
+
+  s.dut->io_i_host_uart_config_0_en = 1;
+  s.dut->io_i_host_uart_config_0_is8bit = 1;
+  s.dut->io_i_host_uart_config_0_parity = 1;
+  s.dut->io_i_host_uart_config_0_stop = 1;
+  s.dut->io_i_host_uart_config_0_cycle = batch_nuartcycle;
+  s.dut->io_b_host_uart_port_0_rec_0_ready = 1;
+
+  // The ROM is read-only and shared by all the programs
+  if (batch_rom != NULL) {
+    Verilated::threadContextp(s.ctx);
+    svSetScope(svGetScopeFromName(BATCH_SCOPE_ROM));
+    s.dut->ext_readmemh_byte(batch_rom);
+  }
+}
+
+void batch_free(BatchSlot &s) {
+  s.dut->final();
+  delete s.dut;
+  delete s.ctx;
+}
+
+// Reload in place: boot and RAM are zeroed before the new image so nothing
+// (.bss, stack, unlisted addresses) is carried over from the previous program.
+void batch_load(BatchSlot &s, int id) {
+  // Scopes are registered per context
+  Verilated::threadContextp(s.ctx);
+  s.ctx->gotFinish(false);
+
+  svSetScope(svGetScopeFromName(BATCH_SCOPE_BOOT));
+  s.dut->ext_readmemh_byte(batch_zero_boot.c_str());
+  s.dut->ext_readmemh_byte(batch_prog[id].c_str());
+  if (CheeseSimConfig::USERAM) {
+    svSetScope(svGetScopeFromName(BATCH_SCOPE_RAM));
+    s.dut->ext_readmemh_byte(batch_zero_ram.c_str());
+  }
+
+  for (int i = 0; i < BATCH_NRESET; i++) {
+    s.dut->clock = 0;
+    s.dut->reset = 1;
+    s.dut->eval();
+    s.dut->clock = 1;
+    s.dut->eval();
+  }
+  s.dut->reset = 0;
+
+  s.id = id;
+  s.clock = 0;
+  s.cycle = 0;
+  s.instret = 0;
+}
+
+void batch_write(BatchSlot &s, int t, uint32_t status, uint32_t result) {
+  BatchRecord r;
+
+  r.id = s.id;
+  r.status = status;
+  r.result = result;
+  r.cycle = s.cycle;
+  r.instret = s.instret;
+  r.thread = t;
+  r.clock = s.clock;
+
+  if (f_batch != NULL) {
+    lock_guard<mutex> guard(batch_out_lock);
+    fwrite(&r, sizeof(BatchRecord), 1, f_batch);
+  }
+}
+
+// ******************************
+//            WORKER
+// ******************************
+void batch_worker(int t, int ndut, int ncycle) {
+  vector<BatchSlot> slot(ndut);
+  int nbusy = 0;
+
+  // ------------------------------
+  //           INSTANCES
+  // ------------------------------
+  for (int d = 0; d < ndut; d++) {
+    batch_init(slot[d]);
+
+    int id;
+    if (batch_pop(t, id)) {
+      batch_load(slot[d], id);
+      nbusy++;
+    }
+  }
+
+  // ------------------------------
+  //          ROUND-ROBIN
+  // ------------------------------
+  // One clock cycle per instance and per round.
+  while (nbusy > 0) {
+    for (int d = 0; d < ndut; d++) {
+      BatchSlot &s = slot[d];
+
+      if (s.id < 0) {
+        continue;
+      }
+
+      // $finish and fatal errors go to the thread context
+      Verilated::threadContextp(s.ctx);
+      s.dut->clock = 0;
+      s.dut->eval();
+      s.dut->clock = 1;
+      s.dut->eval();
+      s.clock = s.clock + 1;
+
+      uint32_t gpio = s.dut->io_b_gpio_0_out;
+      bool end = true;
+
+      if ((s.cycle == 0) && (gpio & (1 << GPIOA_BIT_CYCLE))) {
+        s.cycle = s.dut->io_b_gpio_1_out;
+      }
+      if ((s.instret == 0) && (gpio & (1 << GPIOA_BIT_INSTRET))) {
+        s.instret = s.dut->io_b_gpio_1_out;
+      }
+
+      if (gpio & (1 << GPIOA_BIT_END)) {
+        batch_write(s, t, BATCH_STATUS_END, s.dut->io_b_gpio_1_out);
+      } else if (s.ctx->gotFinish()) {
+        batch_write(s, t, BATCH_STATUS_FINISH, 0xffffffff);
+      } else if ((ncycle > 0) && (s.clock >= (uint64_t) ncycle)) {
+        batch_write(s, t, BATCH_STATUS_TIMEOUT, 0xffffffff);
+      } else {
+        end = false;
+      }
+
+      // Next program on this slot
+      if (end) {
+        int id;
+
+        if (batch_pop(t, id)) {
+          batch_load(s, id);
+        } else {
+          s.id = -1;
+          nbusy--;
+        }
+      }
+    }
+  }
+
+  for (int d = 0; d < ndut; d++) {
+    batch_free(slot[d]);
+  }
+}
+
+// ******************************
+//              RUN
+// ******************************
+int batch_run(char *listfile, char *outfile, char *romfile, int ndut, int nthread, int ncycle, int nuartcycle, int argc, char **argv) {
+  // ------------------------------
+  //           PROGRAMS
+  // ------------------------------
+  ifstream f_list;
+  string line;
+
+  f_list.open(listfile);
+  if (f_list.fail()) {
+    cout << "\033[1;31m";
+    cout << "Error: batch file does not exist." << endl;
+    cout << "\033[0m";
+    return 1;
+  }
+
+  while (getline(f_list, line)) {
+    if (!line.empty()) {
+      batch_prog.push_back(line);
+    }
+  }
+  f_list.close();
+
+  // ------------------------------
+  //            THREADS
+  // ------------------------------
+  if (nthread <= 0) {
+    nthread = thread::hardware_concurrency();
+  }
+  if (nthread <= 0) {
+    nthread = 1;
+  }
+  if (!BATCH_MT && (nthread > 1)) {
+    cout << "\033[1;33m";
+    cout << "Warning: single-threaded Verilator runtime, batch mode uses one worker." << endl;
+    cout << "\033[0m";
+    nthread = 1;
+  }
+  if (ndut <= 0) {
+    ndut = 1;
+  }
+
+  batch_rom = romfile;
+  batch_nuartcycle = nuartcycle;
+  batch_argc = argc;
+  batch_argv = argv;
+
+  if (!batch_zero_image(CheeseSimConfig::NBOOTBYTE, batch_zero_boot) || (CheeseSimConfig::USERAM && !batch_zero_image(CheeseSimConfig::NRAMBYTE, batch_zero_ram))) {
+    cout << "\033[1;31m";
+    cout << "Error: batch zero images cannot be created." << endl;
+    cout << "\033[0m";
+    return 1;
+  }
+
+  batch_queue = vector<BatchQueue>(nthread);
+  for (int p = 0; p < (int) batch_prog.size(); p++) {
+    batch_queue[p % nthread].prog.push_back(p);
+  }
+
+  if (outfile != NULL) {
+    f_batch = fopen(outfile, "wb");
+    if (f_batch == NULL) {
+      cout << "\033[1;31m";
+      cout << "Error: batch output file cannot be opened." << endl;
+      cout << "\033[0m";
+      return 1;
+    }
+  }
+
+  // ------------------------------
+  //              RUN
+  // ------------------------------
+  chrono::steady_clock::time_point start = chrono::steady_clock::now();
+  vector<thread> worker;
+
+  for (int t = 0; t < nthread; t++) {
+    worker.push_back(thread(batch_worker, t, ndut, ncycle));
+  }
+  for (int t = 0; t < nthread; t++) {
+    worker[t].join();
+  }
+
+  double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+  if (f_batch != NULL) {
+    fclose(f_batch);
+  }
+  remove(batch_zero_boot.c_str());
+  if (CheeseSimConfig::USERAM) {
+    remove(batch_zero_ram.c_str());
+  }
+
+  // ------------------------------
+  //            REPORT
+  // ------------------------------
+  cout << "BATCH file: " << listfile << endl;
+  cout << "Programs: " << batch_prog.size() << endl;
+  cout << "Threads: " << nthread << " x " << ndut << " DUTs" << endl;
+  cout << "Elapsed time (s): " << elapsed << endl;
+  if (elapsed > 0) {
+    cout << "Programs per second: " << (batch_prog.size() / elapsed) << endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,57 @@
+/*
+ * File: batch.h
+ * Created Date: 2026-10-19 05:25:00 am                                        *
+ * Author: agent                                                               *
+ * -----                                                                       *
+ * Last Modified: 2026-10-19 05:50:00 am
+ * Modified By: agent
+ * -----                                                                       *
+ * License: See LICENSE.md                                                     *
+ * Copyright (c) 2023 HerdWare                                                 *
+ * -----                                                                       *
+ * Description:                                                                *
+ */
+
+
+#ifndef _BATCH_
+#define _BATCH_
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include "VCheeseSim.h"
+
+#include "verilated.h"
+
+#include "configs.h"
+
+
+// Workers load their instances concurrently through svSetScope and the DPI
+// exports, which needs per-thread runtime state: Verilator 5, or Verilator 4
+// (4.210 or newer, for VerilatedContext) built with --threads.
+// Otherwise batch_run falls back to a single worker.
+#if defined(VL_THREADED) || (defined(VERILATOR_VERSION_INTEGER) && (VERILATOR_VERSION_INTEGER >= 5000000))
+  #define BATCH_MT 1
+#else
+  #define BATCH_MT 0
+#endif
+
+#define BATCH_STATUS_END      0
+#define BATCH_STATUS_TIMEOUT  1
+#define BATCH_STATUS_FINISH   2
+
+// One record per program, in completion order (host endianness)
+struct BatchRecord {
+  uint32_t id;        // Line of the program in the batch file
+  uint32_t status;    // BATCH_STATUS_*
+  uint32_t result;    // GPIO result when the end bit is set
+  uint32_t cycle;     // SW cycles (GPIOA_BIT_CYCLE)
+  uint32_t instret;   // SW retired instructions (GPIOA_BIT_INSTRET)
+  uint32_t thread;    // Worker thread
+  uint64_t clock;     // Simulation clock cycles since reset
+};
+
+
+int batch_run(char *listfile, char *outfile, char *romfile, int ndut, int nthread, int ncycle, int nuartcycle, int argc, char **argv);
+
+#endif
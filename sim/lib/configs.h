@@ -16,145 +16,87 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 
+#include <stdint.h>
+#include "VCheeseSim.h"
+
 // ******************************
-//       CORE CONFIGURATION
+//             GPIOS
 // ******************************
-// ------------------------------
-//        CONFIG P32AU1V000
-// ------------------------------
-#ifdef CONFIG_P32AU1V000
-  #define CORE_MAIN aubrac
-  #define CORE_AUBRAC 1
-  #define CORE_SALERS 0
-  #define CORE_ABONDANCE 0
-  #define NDATABIT 32
-  #define NCOMMIT 1
-  #define NCORECOMMIT 1
-// ------------------------------
-//        CONFIG C32AU1V000
-// ------------------------------
-#elif CONFIG_C32AU1V000
-  #define CORE_MAIN aubrac
-  #define CORE_AUBRAC 1
-  #define CORE_SALERS 0
-  #define CORE_ABONDANCE 0
-  #define NDATABIT 32
-  #define NCOMMIT 1
-  #define NCORECOMMIT 1
-// ------------------------------
-//        CONFIG P32AU1V020
-// ------------------------------
-#elif CONFIG_P32AU1V020
-  #define CORE_MAIN aubrac
-  #define CORE_AUBRAC 1
-  #define CORE_SALERS 0
-  #define CORE_ABONDANCE 0
-  #define NDATABIT 32
-  #define NCOMMIT 1
-  #define NCORECOMMIT 1
-// ------------------------------
-//        CONFIG C32AU1V020
-// ------------------------------
-#elif CONFIG_C32AU1V020
-  #define CORE_MAIN aubrac
-  #define CORE_AUBRAC 1
-  #define CORE_SALERS 0
-  #define CORE_ABONDANCE 0
-  #define NDATABIT 32
-  #define NCOMMIT 1
-  #define NCORECOMMIT 1
-// ------------------------------
-//        CONFIG C32AU1V021
-// ------------------------------
-#elif CONFIG_C32AU1V021
-  #define CORE_MAIN aubrac
-  #define CORE_AUBRAC 1
-  #define CORE_SALERS 0
-  #define CORE_ABONDANCE 0
-  #define NDATABIT 32
-  #define NCOMMIT 1
-  #define NCORECOMMIT 1
-// ------------------------------
-//        CONFIG P32SA1V000
-// ------------------------------
-#elif CONFIG_P32SA1V000
-  #define CORE_MAIN salers
-  #define CORE_AUBRAC 0
-  #define CORE_SALERS 1
-  #define CORE_ABONDANCE 0
-  #define NDATABIT 32
-  #define NCOMMIT 2
-  #define NCORECOMMIT 2
-// ------------------------------
-//        CONFIG P32AB1V000
-// ------------------------------
-#elif CONFIG_P32AB1V000
-  #define CORE_MAIN abondance
-  #define CORE_AUBRAC 0
-  #define CORE_SALERS 0
-  #define CORE_ABONDANCE 1
-  #define NDATABIT 32
-  #define NCOMMIT 2
-  #define NCORECOMMIT 2
-// ------------------------------
-//        CONFIG C32AB1V000
-// ------------------------------
-#elif CONFIG_C32AB1V000
-  #define CORE_MAIN abondance
-  #define CORE_AUBRAC 0
-  #define CORE_SALERS 0
-  #define CORE_ABONDANCE 1
-  #define NDATABIT 32
-  #define NCOMMIT 2
-  #define NCORECOMMIT 2
-// ------------------------------
-//        CONFIG P32AB1V020
-// ------------------------------
-#elif CONFIG_P32AB1V020
-  #define CORE_MAIN abondance
-  #define CORE_AUBRAC 0
-  #define CORE_SALERS 0
-  #define CORE_ABONDANCE 1
-  #define NDATABIT 32
-  #define NCOMMIT 2
-  #define NCORECOMMIT 2
-// ------------------------------
-//        CONFIG C32AB1V020
-// ------------------------------
-#elif CONFIG_C32AB1V020
-  #define CORE_MAIN abondance
-  #define CORE_AUBRAC 0
-  #define CORE_SALERS 0
-  #define CORE_ABONDANCE 1
-  #define NDATABIT 32
-  #define NCOMMIT 2
-  #define NCORECOMMIT 2
-// ------------------------------
-//        CONFIG C32AB1V021
-// ------------------------------
-#elif CONFIG_C32AB1V021
-  #define CORE_MAIN abondance
-  #define CORE_AUBRAC 0
-  #define CORE_SALERS 0
-  #define CORE_ABONDANCE 1
-  #define NDATABIT 32
-  #define NCOMMIT 2
-  #define NCORECOMMIT 2
-// ------------------------------
-//            DEFAULT
-// ------------------------------
-#else
-  #define CORE_MAIN none
-  #define CORE_AUBRAC 0
-  #define CORE_SALERS 0
-  #define CORE_ABONDANCE 0
-  #define NDATABIT 32
-  #define NCOMMIT 0
-  #define NCORECOMMIT 0
-#endif
+#define GPIOA_BIT_UARTW   27
+#define GPIOA_BIT_CYCLE   29
+#define GPIOA_BIT_INSTRET 30
+#define GPIOA_BIT_END     31
 
-#define DBG_CORE_SIGNAL(core, num, signal) DBG_CORE_SIGNAL_(core, num, signal)
-#define DBG_CORE_SIGNAL_(core, num, signal) \
-  dut->io_o_dbg_##core##_##num##_##signal
+// ******************************
+//         CORE CATEGORIES
+// ******************************
+enum CoreKind {
+  CORE_AUBRAC = 0,
+  CORE_SALERS = 1,
+  CORE_ABONDANCE = 2
+};
 
-#endif
\ No newline at end of file
+// ******************************
+//        EXECUTION TRACKER
+// ******************************
+struct EtdEntry {
+  uint64_t done;
+  uint64_t hart;
+  uint64_t pc;
+  uint64_t instr;
+  uint64_t tstart;
+  uint64_t tend;
+  uint64_t daddr;
+};
+
+// Specialized for each commit port in CheeseSimConfig.h
+template <int C> struct EtdPort;
+
+// ******************************
+//  HARDWARE PERFORMANCE COUNTERS
+// ******************************
+struct HpcCounters {
+  uint64_t alu;
+  uint64_t bru;
+  uint64_t cycle;
+  uint64_t instret;
+  uint64_t l1ihit;
+  uint64_t l1imiss;
+  uint64_t l1ipftch;
+  uint64_t l1dhit;
+  uint64_t l1dmiss;
+  uint64_t l1dpftch;
+  uint64_t l2hit;
+  uint64_t l2miss;
+  uint64_t l2pftch;
+  uint64_t ld;
+  uint64_t rdcycle;
+  uint64_t st;
+  uint64_t time;
+  uint64_t call;
+  uint64_t ret;
+  uint64_t jal;
+  uint64_t jalr;
+  uint64_t cflush;
+  uint64_t srcdep;
+};
+
+// Specialized for each core in CheeseSimConfig.h
+template <int K, int N> struct HpcPort;
+
+// ******************************
+//            STIMULUS
+// ******************************
+struct StimPortInfo {
+  const char *name;
+  int width;
+};
+
+// ******************************
+//       CORE CONFIGURATION
+// ******************************
+// Generated by CheeseSimHeader with the Verilog of each configuration:
+// the harness no longer needs a CONFIG_* define.
+#include "CheeseSimConfig.h"
+
+#endif
@@ -23,7 +23,7 @@ void etd_init_trace(char *file) {
 }
 
 void etd_write_trace(VCheeseSim *dut) {
-  ETD_NTRACE(NCOMMIT)
+  EtdTrace<(CheeseSimConfig::DEBUG ? CheeseSimConfig::NCOMMIT : 0)>::write(dut, f_etd);
 }
 
 void etd_close_trace() {
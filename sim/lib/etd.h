@@ -28,29 +28,29 @@ using namespace std;
 #include "configs.h"
 
 
-#define ETD_TRACE(commit) \
-if (dut->io_o_etd_##commit##_done == 1) {                                             \
-  f_etd << setfill('0') << setw(8) << hex << dut->io_o_etd_##commit##_hart << " ";    \
-  f_etd << setfill('0') << setw(8) << hex << dut->io_o_etd_##commit##_pc << " ";      \
-  f_etd << setfill('0') << setw(8) << hex << dut->io_o_etd_##commit##_instr << " ";   \
-  f_etd << setfill('0') << setw(8) << dec << dut->io_o_etd_##commit##_tstart << " ";  \
-  f_etd << setfill('0') << setw(8) << dec << dut->io_o_etd_##commit##_tend << " ";    \
-  f_etd << setfill('0') << setw(8) << hex << dut->io_o_etd_##commit##_daddr << " ";   \
-  f_etd << "\n";                                                                      \
-}  
-
-#define INSERT_NOPS_1   nop; INSERT_NOPS_0
-#define ETD_TRACE_1 ETD_TRACE(0)
-#define ETD_TRACE_2 ETD_TRACE_1;  ETD_TRACE(1)
-#define ETD_TRACE_3 ETD_TRACE_2;  ETD_TRACE(2)
-#define ETD_TRACE_4 ETD_TRACE_3;  ETD_TRACE(3)
-#define ETD_TRACE_5 ETD_TRACE_4;  ETD_TRACE(4)
-#define ETD_TRACE_6 ETD_TRACE_5;  ETD_TRACE(5)
-#define ETD_TRACE_7 ETD_TRACE_6;  ETD_TRACE(6)
-#define ETD_TRACE_8 ETD_TRACE_7;  ETD_TRACE(7)
-
-#define ETD_NTRACE_(commit) ETD_TRACE_##commit
-#define ETD_NTRACE(commit) ETD_NTRACE_(commit)
+// Unrolled at compile time over the commit ports
+template <int C> struct EtdTrace {
+  static inline void write(VCheeseSim *dut, ofstream &f) {
+    EtdTrace<C - 1>::write(dut, f);
+
+    if (EtdPort<C - 1>::done(dut)) {
+      EtdEntry e;
+
+      EtdPort<C - 1>::read(dut, e);
+      f << setfill('0') << setw(8) << hex << e.hart << " ";
+      f << setfill('0') << setw(8) << hex << e.pc << " ";
+      f << setfill('0') << setw(8) << hex << e.instr << " ";
+      f << setfill('0') << setw(8) << dec << e.tstart << " ";
+      f << setfill('0') << setw(8) << dec << e.tend << " ";
+      f << setfill('0') << setw(8) << hex << e.daddr << " ";
+      f << "\n";
+    }
+  }
+};
+
+template <> struct EtdTrace<0> {
+  static inline void write(VCheeseSim *, ofstream &) {}
+};
 
 
 void etd_init_trace(char *file);
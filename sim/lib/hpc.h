@@ -23,44 +23,59 @@
 #include "configs.h"
 
 
-#define HPC_DISPLAY(core, num) \
-cout << "------------------------------" << endl; \
-cout << "CORE: " #core " " #num "" << endl; \
-cout << "------------------------------" << endl; \
-cout << "ALU instructions: " << dut->io_o_dbg_##core##_##num##_hpc_alu << endl; \
-cout << "BRU instructions: " << dut->io_o_dbg_##core##_##num##_hpc_bru << endl; \
-cout << "Cycles: " << dut->io_o_dbg_##core##_##num##_hpc_cycle << endl; \
-cout << "Retired instructions: " << dut->io_o_dbg_##core##_##num##_hpc_instret << endl; \
-cout << "L1I hits: " << dut->io_o_dbg_##core##_##num##_hpc_l1ihit << endl; \
-cout << "L1I misses: " << dut->io_o_dbg_##core##_##num##_hpc_l1imiss << endl; \
-cout << "L1I prefetches: " << dut->io_o_dbg_##core##_##num##_hpc_l1ipftch << endl; \
-cout << "L1D hits: " << dut->io_o_dbg_##core##_##num##_hpc_l1dhit << endl; \
-cout << "L1D misses: " << dut->io_o_dbg_##core##_##num##_hpc_l1dmiss << endl; \
-cout << "L1D prefetches: " << dut->io_o_dbg_##core##_##num##_hpc_l1dpftch << endl; \
-cout << "L2 hits: " << dut->io_o_dbg_##core##_##num##_hpc_l2hit << endl; \
-cout << "L2 misses: " << dut->io_o_dbg_##core##_##num##_hpc_l2miss << endl; \
-cout << "L2 prefetches: " << dut->io_o_dbg_##core##_##num##_hpc_l2pftch << endl; \
-cout << "Load instructions: " << dut->io_o_dbg_##core##_##num##_hpc_ld << endl; \
-cout << "Read cycle instructions: " << dut->io_o_dbg_##core##_##num##_hpc_rdcycle << endl; \
-cout << "Store instructions: " << dut->io_o_dbg_##core##_##num##_hpc_st << endl; \
-cout << "Time: " << dut->io_o_dbg_##core##_##num##_hpc_time << endl; \
-cout << "Function call instructions: " << dut->io_o_dbg_##core##_##num##_hpc_call << endl; \
-cout << "Function ret instructions: " << dut->io_o_dbg_##core##_##num##_hpc_ret << endl; \
-cout << "JAL instructions: " << dut->io_o_dbg_##core##_##num##_hpc_jal << endl; \
-cout << "JALR instructions: " << dut->io_o_dbg_##core##_##num##_hpc_jalr << endl; \
-cout << "Cache flush instructions: " << dut->io_o_dbg_##core##_##num##_hpc_cflush << endl; \
-cout << "Source dependency wait cycles: " << dut->io_o_dbg_##core##_##num##_hpc_srcdep << endl; \
-cout << "------------------------------" << endl;
+#include <iostream>
+using namespace std;
 
 
+inline void hpc_display(const char *core, int num, const HpcCounters &h) {
+  cout << "------------------------------" << endl;
+  cout << "CORE: " << core << " " << num << endl;
+  cout << "------------------------------" << endl;
+  cout << "ALU instructions: " << h.alu << endl;
+  cout << "BRU instructions: " << h.bru << endl;
+  cout << "Cycles: " << h.cycle << endl;
+  cout << "Retired instructions: " << h.instret << endl;
+  cout << "L1I hits: " << h.l1ihit << endl;
+  cout << "L1I misses: " << h.l1imiss << endl;
+  cout << "L1I prefetches: " << h.l1ipftch << endl;
+  cout << "L1D hits: " << h.l1dhit << endl;
+  cout << "L1D misses: " << h.l1dmiss << endl;
+  cout << "L1D prefetches: " << h.l1dpftch << endl;
+  cout << "L2 hits: " << h.l2hit << endl;
+  cout << "L2 misses: " << h.l2miss << endl;
+  cout << "L2 prefetches: " << h.l2pftch << endl;
+  cout << "Load instructions: " << h.ld << endl;
+  cout << "Read cycle instructions: " << h.rdcycle << endl;
+  cout << "Store instructions: " << h.st << endl;
+  cout << "Time: " << h.time << endl;
+  cout << "Function call instructions: " << h.call << endl;
+  cout << "Function ret instructions: " << h.ret << endl;
+  cout << "JAL instructions: " << h.jal << endl;
+  cout << "JALR instructions: " << h.jalr << endl;
+  cout << "Cache flush instructions: " << h.cflush << endl;
+  cout << "Source dependency wait cycles: " << h.srcdep << endl;
+  cout << "------------------------------" << endl;
+}
 
-#define HPC_DISPLAY_0(core)
-#define HPC_DISPLAY_1(core) HPC_DISPLAY(core, 0)
-#define HPC_DISPLAY_2(core) HPC_DISPLAY_0(core); HPC_DISPLAY(core, 1)
-#define HPC_DISPLAY_3(core) HPC_DISPLAY_1(core); HPC_DISPLAY(core, 2)
-#define HPC_DISPLAY_4(core) HPC_DISPLAY_2(core); HPC_DISPLAY(core, 3)
+// Unrolled at compile time over the N cores of category K
+template <int K, int N> struct HpcDisplay {
+  static inline void display(VCheeseSim *dut, const char *core) {
+    HpcCounters h;
 
-#define HPC_DISPLAY_N_(core,num) HPC_DISPLAY_##num(core)
-#define HPC_DISPLAY_N(core,num) HPC_DISPLAY_N_(core,num)
+    HpcDisplay<K, N - 1>::display(dut, core);
+    HpcPort<K, N - 1>::read(dut, h);
+    hpc_display(core, N - 1, h);
+  }
+};
+
+template <int K> struct HpcDisplay<K, 0> {
+  static inline void display(VCheeseSim *, const char *) {}
+};
+
+inline void hpc_display_all(VCheeseSim *dut) {
+  HpcDisplay<CORE_AUBRAC, (CheeseSimConfig::DEBUG ? CheeseSimConfig::NAUBRAC : 0)>::display(dut, "aubrac");
+  HpcDisplay<CORE_SALERS, (CheeseSimConfig::DEBUG ? CheeseSimConfig::NSALERS : 0)>::display(dut, "salers");
+  HpcDisplay<CORE_ABONDANCE, (CheeseSimConfig::DEBUG ? CheeseSimConfig::NABONDANCE : 0)>::display(dut, "abondance");
+}
 
 #endif
\ No newline at end of file
@@ -0,0 +1,177 @@
+/*
+ * File: stim.cpp
+ * Created Date: 2026-10-19 05:35:00 am                                        *
+ * Author: agent                                                               *
+ * -----                                                                       *
+ * Last Modified: 2026-10-19 06:20:00 am
+ * Modified By: agent
+ * -----                                                                       *
+ * License: See LICENSE.md                                                     *
+ * Copyright (c) 2023 HerdWare                                                 *
+ * -----                                                                       *
+ * Description:                                                                *
+ */
+
+
+#include "stim.h"
+
+#include <string.h>
+#include <iostream>
+#include <queue>
+#include <vector>
+using namespace std;
+
+
+// Events of a same cycle keep their file order
+struct StimItem {
+  StimEvent ev;
+  uint64_t seq;
+};
+
+struct StimItemCmp {
+  bool operator()(const StimItem &a, const StimItem &b) const {
+    if (a.ev.clock != b.ev.clock) {
+      return a.ev.clock > b.ev.clock;
+    }
+    return a.seq > b.seq;
+  }
+};
+
+priority_queue<StimItem, vector<StimItem>, StimItemCmp> stim_queue;
+FILE *f_stim = NULL;
+vector<uint64_t> stim_last;
+bool stim_first = true;
+
+void stim_error(const char *msg) {
+  cout << "\033[1;31m";
+  cout << "Error: " << msg << endl;
+  cout << "\033[0m";
+}
+
+// FNV-1a over the generated port table, so a file only replays on the same ports
+uint32_t stim_port_hash() {
+  uint32_t h = 2166136261u;
+
+  for (int p = 0; p < CheeseSimConfig::NSTIMPORT; p++) {
+    for (const char *c = STIM_PORT[p].name; *c != 0; c++) {
+      h = (h ^ (uint8_t) *c) * 16777619u;
+    }
+    h = (h ^ 0) * 16777619u;
+    h = (h ^ (uint8_t) STIM_PORT[p].width) * 16777619u;
+  }
+
+  return h;
+}
+
+// ******************************
+//            REPLAY
+// ******************************
+bool stim_init_replay(char *file) {
+  StimHeader h;
+  StimEvent ev;
+  uint64_t seq = 0;
+
+  f_stim = fopen(file, "rb");
+  if (f_stim == NULL) {
+    stim_error("stimulus file does not exist.");
+    return false;
+  }
+
+  if ((fread(&h, sizeof(StimHeader), 1, f_stim) != 1) || (memcmp(h.magic, STIM_MAGIC, 8) != 0)) {
+    stim_error("wrong stimulus file format.");
+    stim_close();
+    return false;
+  }
+  if ((h.nport != CheeseSimConfig::NSTIMPORT) || (strncmp(h.config, CheeseSimConfig::NAME, sizeof(h.config)) != 0)) {
+    stim_error("stimulus file recorded with another configuration.");
+    stim_close();
+    return false;
+  }
+  if (h.hash != stim_port_hash()) {
+    stim_error("stimulus file recorded with another port table.");
+    stim_close();
+    return false;
+  }
+
+  // Bad events are rejected: replaying without them would not be bit-exact
+  while (fread(&ev, sizeof(StimEvent), 1, f_stim) == 1) {
+    StimItem it;
+
+    if (ev.port >= CheeseSimConfig::NSTIMPORT) {
+      stim_error("stimulus event on an unknown port.");
+      stim_close();
+      return false;
+    }
+    if ((STIM_PORT[ev.port].width < 64) && ((ev.value >> STIM_PORT[ev.port].width) != 0)) {
+      stim_error("stimulus event value wider than its port.");
+      stim_close();
+      return false;
+    }
+
+    it.ev = ev;
+    it.seq = seq++;
+    stim_queue.push(it);
+  }
+
+  stim_close();
+  return true;
+}
+
+void stim_apply(VCheeseSim *dut, uint64_t clock) {
+  while (!stim_queue.empty() && (stim_queue.top().ev.clock <= clock)) {
+    stim_port_set(dut, stim_queue.top().ev.port, stim_queue.top().ev.value);
+    stim_queue.pop();
+  }
+}
+
+// ******************************
+//            RECORD
+// ******************************
+bool stim_init_record(char *file) {
+  StimHeader h;
+
+  f_stim = fopen(file, "wb");
+  if (f_stim == NULL) {
+    stim_error("stimulus file cannot be opened.");
+    return false;
+  }
+
+  memset(&h, 0, sizeof(StimHeader));
+  memcpy(h.magic, STIM_MAGIC, 8);
+  strncpy(h.config, CheeseSimConfig::NAME, sizeof(h.config) - 1);
+  h.nport = CheeseSimConfig::NSTIMPORT;
+  h.hash = stim_port_hash();
+  fwrite(&h, sizeof(StimHeader), 1, f_stim);
+
+  stim_last.assign(CheeseSimConfig::NSTIMPORT, 0);
+  stim_first = true;
+  return true;
+}
+
+// Only the inputs that changed since the last call are written
+void stim_record(VCheeseSim *dut, uint64_t clock) {
+  StimEvent ev;
+
+  ev.clock = clock;
+  ev.rsvd = 0;
+
+  for (int p = 0; p < CheeseSimConfig::NSTIMPORT; p++) {
+    uint64_t value = stim_port_get(dut, p);
+
+    if (stim_first || (value != stim_last[p])) {
+      ev.port = p;
+      ev.value = value;
+      fwrite(&ev, sizeof(StimEvent), 1, f_stim);
+      stim_last[p] = value;
+    }
+  }
+
+  stim_first = false;
+}
+
+void stim_close() {
+  if (f_stim != NULL) {
+    fclose(f_stim);
+    f_stim = NULL;
+  }
+}
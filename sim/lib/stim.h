@@ -0,0 +1,55 @@
+/*
+ * File: stim.h
+ * Created Date: 2026-10-19 05:35:00 am                                        *
+ * Author: agent                                                               *
+ * -----                                                                       *
+ * Last Modified: 2026-10-19 06:20:00 am
+ * Modified By: agent
+ * -----                                                                       *
+ * License: See LICENSE.md                                                     *
+ * Copyright (c) 2023 HerdWare                                                 *
+ * -----                                                                       *
+ * Description:                                                                *
+ */
+
+
+#ifndef _STIM_
+#define _STIM_
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include "VCheeseSim.h"
+
+#include "configs.h"
+
+
+#define STIM_MAGIC "CHSTIM01"
+
+// File header, followed by StimEvent records (host endianness)
+struct StimHeader {
+  char magic[8];      // STIM_MAGIC
+  char config[24];    // CheeseSimConfig::NAME
+  uint32_t nport;     // CheeseSimConfig::NSTIMPORT
+  uint32_t hash;      // stim_port_hash(): order, names and widths of STIM_PORT
+};
+
+// Value driven on a top-level input (index in STIM_PORT) from a clock cycle.
+// Events are sampled and applied after the rising edge of each cycle, reset
+// cycles included: an event of cycle N drives the inputs of cycle N + 1.
+struct StimEvent {
+  uint64_t clock;
+  uint32_t port;
+  uint32_t rsvd;
+  uint64_t value;
+};
+
+
+uint32_t stim_port_hash();
+bool stim_init_replay(char *file);
+void stim_apply(VCheeseSim *dut, uint64_t clock);
+bool stim_init_record(char *file);
+void stim_record(VCheeseSim *dut, uint64_t clock);
+void stim_close();
+
+#endif
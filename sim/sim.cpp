@@ -31,14 +31,12 @@ using namespace std;
 #include "lib/etd.h"
 #include "lib/hpc.h"
 
+#include "lib/batch.h"
+#include "lib/stim.h"
+
 #define TRIGGER_DELAY 100
 #define RESET_DELAY 50
 
-#define GPIOA_BIT_UARTW   27
-#define GPIOA_BIT_CYCLE   29
-#define GPIOA_BIT_INSTRET 30
-#define GPIOA_BIT_END     31
-
 
 int main(int argc, char **argv) {
   // ******************************
@@ -49,6 +47,8 @@ int main(int argc, char **argv) {
   char* vcdfile;
   char* uartfile;
   char* etdfile;
+  char* stimrecfile;
+  char* stimrepfile;
 
   int nuartcycle = 50;
   int ntrigger = 0;
@@ -65,6 +65,16 @@ int main(int argc, char **argv) {
   bool use_uart_out = false;
   bool use_etd = false;
   bool use_hpc = false;
+  bool use_stim_record = false;
+  bool use_stim_replay = false;
+
+  char* batchfile;        // One .hex per line
+  char* batchout = NULL;  // Binary records
+  int nbatchdut = 4;
+  int nbatchthread = 0;
+  int nbatchcycle = 1000000;
+
+  bool use_batch = false;
 
   for (int a = 1; a < argc; a++) {
     string arg = argv[a];
@@ -118,6 +128,45 @@ int main(int argc, char **argv) {
     if (arg == "--hpc") {
       use_hpc = true;
     }
+    if (arg == "--stim-record") {
+      use_stim_record = true;
+      stimrecfile = argv[a + 1];
+      a++;
+    }
+    if (arg == "--stim-replay") {
+      use_stim_replay = true;
+      stimrepfile = argv[a + 1];
+      a++;
+    }
+    if (arg == "--batch") {
+      use_batch = true;
+      batchfile = argv[a + 1];
+      a++;
+    }
+    if (arg == "--batch-out") {
+      batchout = argv[a + 1];
+      a++;
+    }
+    if (arg == "--batch-dut") {
+      nbatchdut = atoi(argv[a + 1]);
+      a++;
+    }
+    if (arg == "--batch-thread") {
+      nbatchthread = atoi(argv[a + 1]);
+      a++;
+    }
+    if (arg == "--batch-cycle") {
+      nbatchcycle = atoi(argv[a + 1]);
+      a++;
+    }
+  }
+
+  // ******************************
+  //          BATCH MODE
+  // ******************************
+  if (use_batch) {
+    int status = batch_run(batchfile, batchout, (use_rom ? romfile : NULL), nbatchdut, nbatchthread, nbatchcycle, nuartcycle, argc, argv);
+    exit(status);
   }
 
   // ******************************
@@ -196,6 +245,17 @@ int main(int argc, char **argv) {
     return 1;
   }
 
+  // ------------------------------
+  //           STIMULUS
+  // ------------------------------
+  // The replay file is fully loaded before recording starts
+  if (use_stim_replay && !stim_init_replay(stimrepfile)) {
+    return 1;
+  }
+  if (use_stim_record && !stim_init_record(stimrecfile)) {
+    return 1;
+  }
+
   // ******************************
   //         DEFAULT SIGNALS
   // ******************************
@@ -216,6 +276,14 @@ int main(int argc, char **argv) {
     if (use_vcd) {
       dut_trace->dump(clock * 10 + 5);
     }
+
+    // Same sampling point as in the test loop
+    if (use_stim_replay) {
+      stim_apply(dut, clock);
+    }
+    if (use_stim_record) {
+      stim_record(dut, clock);
+    }
     clock = clock + 1;
   }
   dut->reset = 0;
@@ -250,7 +318,9 @@ int main(int argc, char **argv) {
     // ------------------------------
     //             RESET
     // ------------------------------
-    if (use_reset && (clock > nreset) && (clock < (nreset + RESET_DELAY))) {
+    if (use_stim_replay) {
+      // Driven by the stimulus file
+    } else if (use_reset && (clock > nreset) && (clock < (nreset + RESET_DELAY))) {
       dut->reset = 1;
     } else {
       dut->reset = 0;
@@ -262,7 +332,7 @@ int main(int argc, char **argv) {
     // ..............................
     //             WRITE
     // ..............................
-    if (use_uart_in) {    
+    if (use_uart_in && !use_stim_replay) {    
       if (!f_uart.eof() && dut->io_o_host_uart_status_0_idle && (dut->io_b_gpio_0_eno & dut->io_b_gpio_0_out & (1 << GPIOA_BIT_UARTW))) {
         string uart_swbyte;
         uint8_t uart_wbyte;
@@ -285,6 +355,17 @@ int main(int argc, char **argv) {
       }
     }
 
+    // ------------------------------
+    //           STIMULUS
+    // ------------------------------
+    // Inputs of the next cycle
+    if (use_stim_replay) {
+      stim_apply(dut, clock);
+    }
+    if (use_stim_record) {
+      stim_record(dut, clock);
+    }
+
     // ------------------------------
     //             END
     // ------------------------------
@@ -327,7 +408,7 @@ int main(int argc, char **argv) {
   // ------------------------------
   if (use_test) {
     check_result = (result == 0);
-    check_ninst = !use_ninst || ((instret >= ninst) && (instret < ninst + NCORECOMMIT));
+    check_ninst = !use_ninst || ((instret >= ninst) && (instret < ninst + CheeseSimConfig::NCORECOMMIT));
     check_trigger = !use_trigger || (cycle == ntrigger);
 
     if (check_result && check_trigger && check_ninst) {
@@ -382,9 +463,7 @@ int main(int argc, char **argv) {
   //             HPC
   // ------------------------------
   if (use_hpc) {
-    HPC_DISPLAY_N(aubrac, CORE_AUBRAC)
-    HPC_DISPLAY_N(salers, CORE_SALERS)
-    HPC_DISPLAY_N(abondance, CORE_ABONDANCE)
+    hpc_display_all(dut);
   }
 
   // ******************************
@@ -394,6 +473,10 @@ int main(int argc, char **argv) {
     etd_close_trace();
   }
 
+  if (use_stim_record) {
+    stim_close();
+  }
+
   dut_trace->close();
   exit(EXIT_SUCCESS);
 }
@@ -17,8 +17,13 @@ package herd.pltf.cheese
 
 import chisel3._
 import chisel3.util._
+import chisel3.stage.ChiselGeneratorAnnotation
 
 
 object CheeseSimC32AU1V020 extends App {
-  (new chisel3.stage.ChiselStage).emitVerilog(new CheeseSim(new CheeseConfigC32AU1V020(debug = true)), args)
+  val p = new CheeseConfigC32AU1V020(debug = true)
+
+  val annos = (new chisel3.stage.ChiselStage).execute(Array("-X", "verilog") ++ args, Seq(ChiselGeneratorAnnotation(() => new CheeseSim(p))))
+
+  CheeseSimHeader(p, "C32AU1V020", annos)
 }
\ No newline at end of file
@@ -0,0 +1,187 @@
+/*
+ * File: header.scala
+ * Created Date: 2026-10-19 05:20:00 am                                        *
+ * Author: agent                                                               *
+ * -----                                                                       *
+ * Last Modified: 2026-10-19 06:30:00 am
+ * Modified By: agent
+ * -----                                                                       *
+ * License: See LICENSE.md                                                     *
+ * Copyright (c) 2023 HerdWare                                                 *
+ * -----                                                                       *
+ * Description:                                                                *
+ */
+
+
+package herd.pltf.cheese
+
+import chisel3._
+import chisel3.experimental.DataMirror
+import firrtl.AnnotationSeq
+import firrtl.options.TargetDirAnnotation
+import java.io.{File, PrintWriter}
+
+
+// ******************************
+//       SIMULATION HEADER
+// ******************************
+// Emits CheeseSimConfig.h next to the generated Verilog.
+// It holds the constexpr traits of the configuration and the port accessors used by sim/lib.
+object CheeseSimHeader {
+  // ------------------------------
+  //            SIGNALS
+  // ------------------------------
+  val etd: Array[String] = Array("done", "hart", "pc", "instr", "tstart", "tend", "daddr")
+
+  val hpc: Array[String] = Array(
+    "alu", "bru", "cycle", "instret",
+    "l1ihit", "l1imiss", "l1ipftch",
+    "l1dhit", "l1dmiss", "l1dpftch",
+    "l2hit", "l2miss", "l2pftch",
+    "ld", "rdcycle", "st", "time",
+    "call", "ret", "jal", "jalr",
+    "cflush", "srcdep"
+  )
+
+  // ------------------------------
+  //            HELPERS
+  // ------------------------------
+  // Same directory as the Verilog, whatever the form of the option
+  def targetDir(annos: AnnotationSeq): String = {
+    annos.toSeq.collectFirst{case TargetDirAnnotation(d) => d} match {
+      case Some(d) => d
+      case None => throw new Exception("CheeseSimHeader: no target directory in the ChiselStage annotations.")
+    }
+  }
+
+  def nCoreCommit(p: CheeseParams): Int = {
+    if (p.nAbondance > 0) {
+      return p.pAbondance(0).nCommit
+    } else if (p.nSalers > 0) {
+      return p.pSalers(0).nCommit
+    } else {
+      return 1
+    }
+  }
+
+  def bool(b: Boolean): String = if (b) "true" else "false"
+
+  // Top-level inputs of CheeseSim with their Verilator names and widths (up to 64 bits)
+  def inputs(d: Data, name: String, parent: SpecifiedDirection): Seq[(String, Int)] = {
+    val dir = SpecifiedDirection.fromParent(parent, DataMirror.specifiedDirectionOf(d))
+
+    d match {
+      case r: Record => r.elements.toSeq.reverse.flatMap{case (n, e) => inputs(e, name + "_" + n, dir)}
+      case v: Vec[_] => v.getElements.zipWithIndex.flatMap{case (e, i) => inputs(e, name + "_" + i, dir)}
+      case e: Element => {
+        if (((dir == SpecifiedDirection.Input) || (dir == SpecifiedDirection.Flip)) && (e.getWidth > 0) && (e.getWidth <= 64)) {
+          Seq((name, e.getWidth))
+        } else {
+          Seq()
+        }
+      }
+    }
+  }
+
+  // ------------------------------
+  //             EMIT
+  // ------------------------------
+  def apply(p: CheeseParams, name: String, annos: AnnotationSeq): Unit = {
+    val dir = new File(targetDir(annos))
+    dir.mkdirs()
+
+    val f = new PrintWriter(new File(dir, "CheeseSimConfig.h"))
+    val stim: Seq[(String, Int)] = Seq(("reset", 1)) ++ inputs(new CheeseSimIO(p), "io", SpecifiedDirection.Unspecified)
+
+    f.println("// Generated by herd.pltf.cheese.CheeseSimHeader: do not edit.")
+    f.println("// Included by sim/lib/configs.h.")
+    f.println()
+    f.println("#ifndef CHEESE_SIM_CONFIG_H")
+    f.println("#define CHEESE_SIM_CONFIG_H")
+    f.println()
+
+    // Traits
+    f.println("struct CheeseSimConfig {")
+    f.println("  static constexpr const char* NAME = \"" + name + "\";")
+    f.println("  static constexpr bool DEBUG = " + bool(p.debug) + ";")
+    f.println("  static constexpr int NADDRBIT = " + p.nAddrBit + ";")
+    f.println("  static constexpr int NDATABIT = " + p.nDataBit + ";")
+    f.println("  static constexpr int NHART = " + p.nHart + ";")
+    f.println("  static constexpr int NCOMMIT = " + p.nCommit + ";")
+    f.println("  static constexpr int NCORECOMMIT = " + nCoreCommit(p) + ";")
+    f.println("  static constexpr int NAUBRAC = " + p.nAubrac + ";")
+    f.println("  static constexpr int NSALERS = " + p.nSalers + ";")
+    f.println("  static constexpr int NABONDANCE = " + p.nAbondance + ";")
+    f.println("  static constexpr int NGPIO32B = " + p.nGpio32b + ";")
+    f.println("  static constexpr int NUART = " + p.nUart + ";")
+    f.println("  static constexpr bool SPIFLASH = " + bool(p.useSpiFlash) + ";")
+    f.println("  static constexpr bool PS2KB = " + bool(p.usePs2Keyboard) + ";")
+    f.println("  static constexpr int NSPI = " + p.nSpi + ";")
+    f.println("  static constexpr int NI2C = " + p.nI2c + ";")
+    f.println("  static constexpr long NBOOTBYTE = " + BigInt(p.nBootByte, 16) + ";")
+    // m_ram is instantiated with useRom (see Cheese)
+    f.println("  static constexpr bool USERAM = " + bool(p.useRom) + ";")
+    f.println("  static constexpr long NRAMBYTE = " + BigInt(p.nRamByte, 16) + ";")
+    f.println("  static constexpr int NSTIMPORT = " + stim.size + ";")
+    f.println("};")
+    f.println()
+
+    if (p.debug) {
+      // Execution tracker
+      for (c <- 0 until p.nCommit) {
+        f.println("template <> struct EtdPort<" + c + "> {")
+        f.println("  static inline bool done(const VCheeseSim *dut) { return dut->io_o_etd_" + c + "_done; }")
+        f.println("  static inline void read(const VCheeseSim *dut, EtdEntry &e) {")
+        for (s <- etd) {
+          f.println("    e." + s + " = dut->io_o_etd_" + c + "_" + s + ";")
+        }
+        f.println("  }")
+        f.println("};")
+        f.println()
+      }
+
+      // Hardware performance counters
+      for ((core, n) <- Seq(("aubrac", p.nAubrac), ("salers", p.nSalers), ("abondance", p.nAbondance))) {
+        for (c <- 0 until n) {
+          f.println("template <> struct HpcPort<CORE_" + core.toUpperCase + ", " + c + "> {")
+          f.println("  static inline void read(const VCheeseSim *dut, HpcCounters &h) {")
+          for (s <- hpc) {
+            f.println("    h." + s + " = dut->io_o_dbg_" + core + "_" + c + "_hpc_" + s + ";")
+          }
+          f.println("  }")
+          f.println("};")
+          f.println()
+        }
+      }
+    }
+
+    // Stimulus
+    f.println("static const StimPortInfo STIM_PORT[] = {")
+    for ((n, w) <- stim) {
+      f.println("  {\"" + n + "\", " + w + "},")
+    }
+    f.println("};")
+    f.println()
+    f.println("static inline uint64_t stim_port_get(const VCheeseSim *dut, int port) {")
+    f.println("  switch (port) {")
+    for (((n, w), i) <- stim.zipWithIndex) {
+      f.println("    case " + i + ": return dut->" + n + ";")
+    }
+    f.println("    default: return 0;")
+    f.println("  }")
+    f.println("}")
+    f.println()
+    f.println("static inline void stim_port_set(VCheeseSim *dut, int port, uint64_t value) {")
+    f.println("  switch (port) {")
+    for (((n, w), i) <- stim.zipWithIndex) {
+      f.println("    case " + i + ": dut->" + n + " = value; break;")
+    }
+    f.println("    default: break;")
+    f.println("  }")
+    f.println("}")
+    f.println()
+
+    f.println("#endif")
+    f.close()
+  }
+}
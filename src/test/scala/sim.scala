@@ -27,6 +27,25 @@ import herd.io.periph.spi.{SpiIO}
 import herd.io.periph.i2c.{I2cIO}
 
 
+class CheeseSimIO (p: CheeseParams) extends Bundle {
+  val b_gpio = Vec(p.nGpio32b, new BiDirectIO(UInt(32.W)))
+  val b_spi_flash = if (p.useSpiFlash) Some(new SpiIO(1)) else None
+  val b_ps2_kb = if (p.usePs2Keyboard) Some(new Ps2IO()) else None
+  val b_spi = MixedVec(
+    for (ps <- p.pIO.pSpi) yield {
+      new SpiIO(ps.nSlave)
+    }
+  )
+  val b_i2c = Vec(p.nI2c, new I2cIO())
+
+  val o_host_uart_status = Vec(p.nUart, Output(new UartStatusBus()))
+  val i_host_uart_config = Vec(p.nUart, Input(new UartConfigBus()))
+  val b_host_uart_port = Vec(p.nUart, new UartPortIO(p, 8))
+
+  val o_dbg = if (p.debug) Some(Output(new CheeseDbgBus(p))) else None
+  val o_etd = if (p.debug) Some(Output(Vec(p.nCommit, new EtdBus(p.nHart, p.nAddrBit, p.nInstrBit)))) else None
+}
+
 class CheeseSim (p: CheeseParams) extends Module {
 
   def pHostUart: UartParams = new UartConfig (
@@ -36,24 +55,7 @@ class CheeseSim (p: CheeseParams) extends Module {
     nBufferDepth = 8
   )
 
-  val io = IO(new Bundle {
-    val b_gpio = Vec(p.nGpio32b, new BiDirectIO(UInt(32.W)))
-    val b_spi_flash = if (p.useSpiFlash) Some(new SpiIO(1)) else None
-    val b_ps2_kb = if (p.usePs2Keyboard) Some(new Ps2IO()) else None
-    val b_spi = MixedVec(
-      for (ps <- p.pIO.pSpi) yield {
-        new SpiIO(ps.nSlave)
-      }
-    )
-    val b_i2c = Vec(p.nI2c, new I2cIO())
-
-    val o_host_uart_status = Vec(p.nUart, Output(new UartStatusBus()))
-    val i_host_uart_config = Vec(p.nUart, Input(new UartConfigBus()))
-    val b_host_uart_port = Vec(p.nUart, new UartPortIO(p, 8))
-
-    val o_dbg = if (p.debug) Some(Output(new CheeseDbgBus(p))) else None
-    val o_etd = if (p.debug) Some(Output(Vec(p.nCommit, new EtdBus(p.nHart, p.nAddrBit, p.nInstrBit)))) else None
-  })
+  val io = IO(new CheeseSimIO(p))
 
   val m_cheese = Module(new Cheese(p))
 